@@ -0,0 +1,51 @@
+#!/bin/bash
+#
+#  Production station: flash and verify every board that is connected
+#
+#  Usage: ./stm32station.sh <image> [<serial>]
+#
+#  The script waits until a target answers on the stlink, flashes and verifies
+#  the image, prints one result line and waits till the board is removed before
+#  it starts waiting for the next one. The output of a failed board is kept in
+#  eblink_<date>_<time>_board_<n>.log. Stop the station with Ctrl-C.
+#
+
+if [ $# -lt 1 ]; then
+    echo "Usage: $0 <image> [<serial>]"
+    exit 1
+fi
+
+image="$1"
+probe=stlink
+if [ -n "$2" ]; then
+    probe="$probe,serial=$2"
+fi
+
+# Non-intrusive target check, read the CPUID register without reset
+target_present()
+{
+    ./eblink -g -v 0 -I "$probe,dr" -S auto -P ../scripts/ -F read=4@0xE000ED00 > /dev/null 2>&1
+}
+
+board=0
+passed=0
+while true; do
+    echo "Waiting for board..."
+    until target_present; do sleep 0.5; done
+
+    board=$((board+1))
+    log="eblink_$(date +%Y%m%d_%H%M%S)_board_$board.log"
+    start=$(date +%s%N)
+    if ./eblink -g -I "$probe" -S auto -P ../scripts/ -F "verify,run,file=$image" > "$log" 2>&1; then
+        result="PASS"
+        passed=$((passed+1))
+        rm -f "$log"
+    else
+        result="FAIL (see $log)"
+    fi
+    elapsed=$(( ($(date +%s%N) - start) / 1000000 ))
+    printf "Board %d: %s %d.%03ds  [%d/%d passed]\n" $board "$result" $((elapsed/1000)) $((elapsed%1000)) $passed $board
+
+    echo "Remove board..."
+    while target_present; do sleep 0.5; done
+done
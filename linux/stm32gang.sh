@@ -0,0 +1,60 @@
+#!/bin/bash
+#
+#  Gang programming: flash one image with several stlink probes in parallel
+#
+#  Usage: ./stm32gang.sh <image> <serial> [<serial> ...]
+#
+#  Every probe gets its own eblink process (selected with serial=). The output of
+#  each process is kept in eblink_<serial>.log and a pass/fail table with the
+#  flash time per probe is printed when all boards are done.
+#
+
+if [ $# -lt 2 ]; then
+    echo "Usage: $0 <image> <serial> [<serial> ...]"
+    exit 1
+fi
+
+image="$1"
+shift
+
+# Every probe needs its own log and result file
+declare -A seen
+for serial in "$@"; do
+    if [ -n "${seen[$serial]}" ]; then
+        echo "Serial $serial is given more than once"
+        exit 1
+    fi
+    seen[$serial]=1
+done
+
+for serial in "$@"; do
+    rm -f "eblink_$serial.result"
+    (
+        start=$(date +%s%N)
+        ./eblink -g -I "stlink,serial=$serial" -S auto -P ../scripts/ -F "verify,run,file=$image" > "eblink_$serial.log" 2>&1
+        echo $? $(( ($(date +%s%N) - start) / 1000000 )) > "eblink_$serial.result"
+    ) &
+done
+wait
+
+failed=0
+printf "\n%-26s %-6s %s\n" "Probe" "Result" "Time(s)"
+for serial in "$@"; do
+    # A worker that died without a result counts as failed
+    code=1
+    elapsed=0
+    if [ -f "eblink_$serial.result" ]; then
+        read code elapsed < "eblink_$serial.result"
+        rm -f "eblink_$serial.result"
+    fi
+    if [ "$code" = "0" ]; then
+        result="PASS"
+    else
+        result="FAIL"
+        failed=$((failed+1))
+    fi
+    printf "%-26s %-6s %d.%03d\n" "$serial" "$result" $((${elapsed:-0}/1000)) $((${elapsed:-0}%1000))
+done
+
+printf "\n%d of %d boards passed\n" $(($# - failed)) $#
+exit $failed